@@ -8,15 +8,21 @@
 #include <chrono>
 #include <random>
 #include <fstream>
+#include <cmath>
+#include <algorithm>
 
 using namespace std::string_literals;
 
 // #define SHOW_COLLIDERS
+// #define SHOW_FRAME_STATS
 
 // Screen width and height
 constexpr int kScreenWidth {640};
 constexpr int kScreenHeight {480};
 
+// Speed the rocks and the ground scroll at
+constexpr float kScrollSpeed {-200.0f};
+
 // Deltatime
 Uint64 last_tick {0};
 Uint64 current_tick {0};
@@ -26,6 +32,16 @@ float delta_time;
 SDL_Window* globalWindow {nullptr};
 SDL_Renderer* globalRenderer {nullptr};
 
+// Event pushed to switch scenes
+Uint32 sceneChangeEvent {0};
+
+// Offscreen target the scene is drawn into before being upscaled to the window
+SDL_Texture* sceneTarget {nullptr};
+bool useDynamicResolution {true};
+
+// Redraws only the regions that changed into the scene target, which then keeps its contents between frames
+bool useDirtyRects {false};
+
 /* Collision Box 2D */
 struct CollisionBox2D
 {
@@ -35,27 +51,79 @@ struct CollisionBox2D
     float y2;
 };
 
+/* Collision event found by the swept test */
+enum collisionType
+{
+    crash,
+    scoreGate
+};
+struct CollisionEvent
+{
+    float time;
+    collisionType type;
+};
+
 /* Function Prototypes */
 SDL_Texture* getTextureFromFile(std::string path);
 void spawnRocks();
-bool isBetween(float between, float a, float b);
-bool isCollided(CollisionBox2D box1, CollisionBox2D box2);
+bool sweptCollision(CollisionBox2D box1, const std::vector<float>& move1, CollisionBox2D box2, const std::vector<float>& move2, float& timeOfImpact);
 SDL_Texture* createTextSurface(std::string text, SDL_Color textColor, std::string fontPath, int fontSize);
+void beginScene(float scale);
+void presentScene(float scale);
+void changeScene(int nextScene);
 
 template<typename T>
 void clamp(T& toClamp, T minimum, T maximum);
 
-bool isCollided(CollisionBox2D box1, CollisionBox2D box2)
+// Checks two boxes moving over one step, given where they ended up and how far they moved.
+// timeOfImpact is the fraction of the step at which they first touch.
+bool sweptCollision(CollisionBox2D box1, const std::vector<float>& move1, CollisionBox2D box2, const std::vector<float>& move2, float& timeOfImpact)
 {
-    if (isBetween(box1.x1, box2.x1, box2.x2) && isBetween(box1.y1, box2.y1, box2.y2))
-    {
-        return true;
-    }
-    else
+    // Working in box2's frame, so only box1 moves
+    float start1[2][2] {
+        {std::min(box1.x1, box1.x2) - move1[0], std::max(box1.x1, box1.x2) - move1[0]},
+        {std::min(box1.y1, box1.y2) - move1[1], std::max(box1.y1, box1.y2) - move1[1]}
+    };
+    float start2[2][2] {
+        {std::min(box2.x1, box2.x2) - move2[0], std::max(box2.x1, box2.x2) - move2[0]},
+        {std::min(box2.y1, box2.y2) - move2[1], std::max(box2.y1, box2.y2) - move2[1]}
+    };
+    float move[2] {move1[0] - move2[0], move1[1] - move2[1]};
+
+    float enterTime {0.0f};
+    float exitTime {1.0f};
+    for (int axis = 0; axis < 2; axis++)
     {
-        return false;
+        if (move[axis] == 0.0f)
+        {
+            // Not moving on this axis, so they have to overlap on it the whole step
+            if (start1[axis][1] <= start2[axis][0] || start1[axis][0] >= start2[axis][1])
+            {
+                return false;
+            }
+        }
+        else
+        {
+            float enter {(start2[axis][0] - start1[axis][1]) / move[axis]};
+            float exit {(start2[axis][1] - start1[axis][0]) / move[axis]};
+            if (enter > exit)
+            {
+                std::swap(enter, exit);
+            }
+
+            enterTime = std::max(enterTime, enter);
+            exitTime = std::min(exitTime, exit);
+            if (enterTime > exitTime)
+            {
+                return false;
+            }
+        }
     }
+
+    timeOfImpact = enterTime;
+    return true;
 }
+
 // GameObject class
 class GameObject
 {
@@ -72,19 +140,29 @@ class GameObject
     // Physics attributes
     std::vector<float> position {};
     std::vector<float> velocity {};
+    // How far the last updatePosition moved it, used by the swept collision check
+    std::vector<float> displacement {0, 0};
 
     bool isVisible {true};
 
+    // Static objects never move or change, so they never cause a redraw
+    bool isStatic {false};
+    // Where it was drawn last frame, used by the dirty rectangle renderer
+    SDL_FRect lastBounds {};
+    bool wasDrawn {false};
+
     SDL_Texture* myTexture;
 
     CollisionBox2D myCollider;
     
-    void render();
+    virtual void render();
     void destroy();
-    void updatePosition()
+    SDL_FRect getBounds();
+    virtual void updatePosition()
     {
-        position[0] += velocity[0] * delta_time;
-        position[1] += velocity[1] * delta_time;
+        displacement = {velocity[0] * delta_time, velocity[1] * delta_time};
+        position[0] += displacement[0];
+        position[1] += displacement[1];
     }
 };
 GameObject::~GameObject()
@@ -112,6 +190,21 @@ void GameObject::render()
         #endif
     }
 }
+// The area the rotated texture covers on screen
+SDL_FRect GameObject::getBounds()
+{
+    double radians {degrees * SDL_PI_D / 180.0};
+    float cosine {static_cast<float>(std::fabs(std::cos(radians)))};
+    float sine {static_cast<float>(std::fabs(std::sin(radians)))};
+
+    float halfWidth {(cosine * myWidth + sine * myHeight) / 2.0f};
+    float halfHeight {(sine * myWidth + cosine * myHeight) / 2.0f};
+    float centerX {position[0] + myWidth / 2.0f};
+    float centerY {position[1] + myHeight / 2.0f};
+
+    // One pixel of padding for rounding and filtering
+    return {centerX - halfWidth - 1.0f, centerY - halfHeight - 1.0f, 2.0f * halfWidth + 2.0f, 2.0f * halfHeight + 2.0f};
+}
 void GameObject::destroy()
 {
     SDL_DestroyTexture(myTexture);
@@ -120,29 +213,73 @@ void GameObject::destroy()
     myHeight = 0;
 }
 
-// Background class
+// Background class, the sky and the background image are composed once into a screen sized layer
 class Background : public GameObject
 {
     public:
     Background();
     ~Background();
+
+    void compose();
+    void render();
 };
 Background::Background()
 {
-    myTexture = getTextureFromFile("../../assets/background.png");
-    
-    myWidth = myTexture->w * size;
-    myHeight = myTexture->h * size;
+    myTexture = nullptr;
+    myWidth = kScreenWidth;
+    myHeight = kScreenHeight;
 
-    position = {static_cast<float>((kScreenWidth - myWidth) / 2), static_cast<float>((kScreenHeight - myHeight) / 2)};
+    compose();
+
+    position = {0.0f, 0.0f};
     velocity = {0, 0};
     degrees = {0.0};
+    isStatic = true;
+
+}
+// Builds the layer, called again when the renderer loses its target textures
+void Background::compose()
+{
+    SDL_DestroyTexture(myTexture);
+    SDL_Texture* image = getTextureFromFile("../../assets/background.png");
+
+    // Composing the layer
+    myTexture = SDL_CreateTexture(globalRenderer, SDL_PIXELFORMAT_XRGB8888, SDL_TEXTUREACCESS_TARGET, kScreenWidth, kScreenHeight);
+    if (myTexture == nullptr)
+    {
+        SDL_Log("Unable to create background layer! SDL error: %s\n", SDL_GetError());
+    }
+    else
+    {
+        SDL_SetRenderTarget(globalRenderer, myTexture);
+        SDL_SetRenderDrawColor(globalRenderer, 0x90, 0xB6, 0xFC, 0xFF);
+        SDL_RenderClear(globalRenderer);
 
+        if (image != nullptr)
+        {
+            SDL_FRect imageRect {(kScreenWidth - image->w * size) / 2, (kScreenHeight - image->h * size) / 2, image->w * size, image->h * size};
+            SDL_RenderTexture(globalRenderer, image, nullptr, &imageRect);
+        }
+
+        SDL_SetRenderTarget(globalRenderer, nullptr);
+
+        // Opaque, so it's a plain copy every frame
+        SDL_SetTextureBlendMode(myTexture, SDL_BLENDMODE_NONE);
+    }
+    SDL_DestroyTexture(image);
 }
 Background::~Background()
 {
     destroy();
 }
+void Background::render()
+{
+    if (isVisible)
+    {
+        SDL_FRect dstRect {position[0], position[1], myWidth, myHeight};
+        SDL_RenderTexture(globalRenderer, myTexture, nullptr, &dstRect);
+    }
+}
 
 // Text
 class TextMessage : public GameObject
@@ -157,6 +294,9 @@ class TextMessage : public GameObject
 
     SDL_Color myColor;
     int pointSize {};
+
+    // The text the current texture was made from
+    std::string renderedMessage {""};
     
     void updateTexture();
 };
@@ -176,6 +316,7 @@ TextMessage::TextMessage()
     pointSize = 28;
 
     myTexture = createTextSurface(message, myColor, fontPath, pointSize);
+    renderedMessage = message;
 
     myWidth = myTexture->w;
     myHeight = myTexture->h;
@@ -200,6 +341,7 @@ TextMessage::TextMessage(std::string newMessage, int newPointSize, bool visibili
     pointSize = newPointSize;
 
     myTexture = createTextSurface(message, myColor, fontPath, pointSize);
+    renderedMessage = message;
 
     myWidth = myTexture->w;
     myHeight = myTexture->h;
@@ -213,7 +355,15 @@ TextMessage::~TextMessage()
 }
 void TextMessage::updateTexture()
 {
+    // Only remaking the texture when the text changed
+    if (message == renderedMessage)
+    {
+        return;
+    }
+
+    SDL_DestroyTexture(myTexture);
     myTexture = createTextSurface(message, myColor, fontPath, pointSize);
+    renderedMessage = message;
 }
 
 SDL_Texture* createTextSurface(std::string text, SDL_Color textColor, std::string fontPath, int fontSize)
@@ -242,7 +392,9 @@ SDL_Texture* createTextSurface(std::string text, SDL_Color textColor, std::strin
             {
                 SDL_Log("Unable to create texture from text surface! SDL error:%s\n", SDL_GetError());
             }
+            SDL_DestroySurface(textSurface);
         }
+        TTF_CloseFont(myFont);
     }
     return texture;
 }
@@ -273,8 +425,9 @@ class Plane : public GameObject
     }
     void updatePosition()
     {
-        position[0] += velocity[0] * delta_time;
-        position[1] += velocity[1] * delta_time;
+        displacement = {velocity[0] * delta_time, velocity[1] * delta_time};
+        position[0] += displacement[0];
+        position[1] += displacement[1];
 
         myCollider.x1 = position[0] + (myWidth / 7);
         myCollider.x2 = position[0] + (6 * myWidth / 7);
@@ -301,22 +454,57 @@ Plane::~Plane()
     destroy();
 }
 
+enum rockType
+{
+    dirt,
+    grass,
+    ice,
+    snow
+};
+
+// Ground class, the biomes are composed once into a strip that is drawn tiled and scrolled
 class Ground : public GameObject
 {
     public:
-    Ground();
+    Ground(std::vector<rockType> biomes);
     ~Ground();
+
+    std::vector<rockType> myBiomes {};
+
+    // How far into the strip the left edge of the screen is
+    float scrollOffset {0.0f};
+    float stripWidth {0.0f};
+
+    void compose();
+    void render();
+    void updatePosition()
+    {
+        // Only the texture scrolls, the collider stays put
+        displacement = {0.0f, 0.0f};
+        if (stripWidth <= 0.0f)
+        {
+            return;
+        }
+        scrollOffset = std::fmod(scrollOffset - velocity[0] * delta_time, stripWidth);
+        if (scrollOffset < 0.0f)
+        {
+            scrollOffset += stripWidth;
+        }
+    }
 };
-Ground::Ground()
+Ground::Ground(std::vector<rockType> biomes)
 {
-    myTexture = getTextureFromFile("../../assets/groundSnow.png");
-    myWidth = myTexture->w * size;
-    myHeight = myTexture->h * size;
+    myTexture = nullptr;
+    myBiomes = biomes;
+    compose();
+
+    myWidth = kScreenWidth;
 
-    position = {static_cast<float>((kScreenWidth - myWidth) / 2), static_cast<float>(kScreenHeight - myHeight)};
+    position = {0.0f, static_cast<float>(kScreenHeight - myHeight)};
 
     velocity = {0,0};
     degrees = {0.0};
+    isStatic = true;
 
     myCollider.x1 = position[0];
     myCollider.x2 = position[0] + kScreenWidth;
@@ -324,18 +512,106 @@ Ground::Ground()
     myCollider.y1 = position[1] + myHeight / 5;
     myCollider.y2 = position[1] + (myHeight);
 }
+// Builds the strip, called again when the renderer loses its target textures
+void Ground::compose()
+{
+    SDL_DestroyTexture(myTexture);
+
+    // The strip has to fit in one texture, 0 means the renderer has no limit
+    float maxTextureSize {static_cast<float>(SDL_GetNumberProperty(SDL_GetRendererProperties(globalRenderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 0))};
+
+    // Loading each biome
+    std::vector<SDL_Texture*> tiles {};
+    float stripHeight {0.0f};
+    stripWidth = 0.0f;
+    for (rockType biome : myBiomes)
+    {
+        SDL_Texture* tile {nullptr};
+        if (biome == dirt)
+        {
+            tile = getTextureFromFile("../../assets/groundDirt.png"s);
+        }
+        else if (biome == grass)
+        {
+            tile = getTextureFromFile("../../assets/groundGrass.png"s);
+        }
+        else if (biome == ice)
+        {
+            tile = getTextureFromFile("../../assets/groundIce.png"s);
+        }
+        else if (biome == snow)
+        {
+            tile = getTextureFromFile("../../assets/groundSnow.png"s);
+        }
+
+        // Leaving out the biomes that would make the strip too wide
+        if (tile != nullptr && maxTextureSize > 0.0f && stripWidth + tile->w > maxTextureSize)
+        {
+            SDL_Log("Ground strip is limited to %.0f px by the max texture size, only %d of %d biomes are used!\n",
+                maxTextureSize, static_cast<int>(tiles.size()), static_cast<int>(myBiomes.size()));
+            SDL_DestroyTexture(tile);
+            break;
+        }
+
+        if (tile != nullptr)
+        {
+            tiles.push_back(tile);
+            stripWidth += tile->w;
+            stripHeight = std::fmax(stripHeight, static_cast<float>(tile->h));
+        }
+    }
+
+    // Composing the strip, keeping the transparency along the top edge
+    myTexture = SDL_CreateTexture(globalRenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, static_cast<int>(stripWidth), static_cast<int>(stripHeight));
+    if (myTexture == nullptr)
+    {
+        SDL_Log("Unable to create ground strip! SDL error: %s\n", SDL_GetError());
+    }
+    else
+    {
+        SDL_SetRenderTarget(globalRenderer, myTexture);
+        SDL_SetRenderDrawColor(globalRenderer, 0x00, 0x00, 0x00, 0x00);
+        SDL_RenderClear(globalRenderer);
+
+        float x {0.0f};
+        for (SDL_Texture* tile : tiles)
+        {
+            SDL_FRect tileRect {x, stripHeight - tile->h, static_cast<float>(tile->w), static_cast<float>(tile->h)};
+            SDL_SetTextureBlendMode(tile, SDL_BLENDMODE_NONE);
+            SDL_RenderTexture(globalRenderer, tile, nullptr, &tileRect);
+            x += tile->w;
+        }
+
+        SDL_SetRenderTarget(globalRenderer, nullptr);
+        SDL_SetTextureBlendMode(myTexture, SDL_BLENDMODE_BLEND);
+    }
+    for (SDL_Texture* tile : tiles)
+    {
+        SDL_DestroyTexture(tile);
+    }
+
+    stripWidth *= size;
+    myHeight = stripHeight * size;
+}
 Ground::~Ground()
 {
     destroy();
 }
-
-enum rockType
+void Ground::render()
 {
-    dirt,
-    grass,
-    ice,
-    snow
-};
+    if (isVisible && myTexture != nullptr)
+    {
+        // One tiled draw covers the screen however many biomes the strip has
+        SDL_FRect dstRect {position[0] - scrollOffset, position[1], myWidth + scrollOffset, myHeight};
+        SDL_RenderTextureTiled(globalRenderer, myTexture, nullptr, size, &dstRect);
+
+        #ifdef SHOW_COLLIDERS
+        SDL_FRect colliderRect {myCollider.x1, myCollider.y1, myCollider.x2 - myCollider.x1, myCollider.y2 - myCollider.y1};
+        SDL_RenderRect(globalRenderer, &colliderRect);
+        #endif
+    }
+}
+
 // Rock class
 class Rock : public GameObject 
 {
@@ -350,8 +626,9 @@ class Rock : public GameObject
 
     void updatePosition()
     {
-        position[0] += velocity[0] * delta_time;
-        position[1] += velocity[1] * delta_time;
+        displacement = {velocity[0] * delta_time, velocity[1] * delta_time};
+        position[0] += displacement[0];
+        position[1] += displacement[1];
 
         myCollider.x1 = position[0] + (myWidth / 3);
         myCollider.x2 = position[0] + (2 * myWidth / 3);
@@ -411,6 +688,338 @@ Rock::~Rock()
 {
     destroy();
 }
+
+// Resolution scaler class
+class ResolutionScaler
+{
+    public:
+    float scale {1.0f};
+    float minimumScale {0.5f};
+    float targetFrameTime {1.0f / 60.0f};
+
+    float averageFrameTime {0.0f};
+    float timeSinceChange {0.0f};
+
+    void update(float frameTime);
+};
+void ResolutionScaler::update(float frameTime)
+{
+    // Smoothing so a single slow frame doesn't change the resolution
+    averageFrameTime += (frameTime - averageFrameTime) * 0.1f;
+    timeSinceChange += frameTime;
+
+    // Giving the average time to settle after each change
+    if (timeSinceChange < 0.5f || averageFrameTime <= 0.0f)
+    {
+        return;
+    }
+
+    // Fill cost grows with the pixel count, so the scale follows the square root of the frame time ratio
+    float wantedScale = scale * std::sqrt(targetFrameTime / averageFrameTime);
+    clamp(wantedScale, minimumScale, 1.0f);
+
+    // Dropping quickly when too slow, but only creeping back up to avoid oscillating
+    if (wantedScale < scale - 0.02f)
+    {
+        scale = wantedScale;
+        timeSinceChange = 0.0f;
+    }
+    else if (wantedScale > scale + 0.05f)
+    {
+        scale = std::fmin(scale + 0.05f, 1.0f);
+        timeSinceChange = 0.0f;
+    }
+}
+
+enum sceneType
+{
+    menuScene,
+    playingScene,
+    gameOverScene,
+    sceneCount
+};
+// Scene class, only the objects in its lists are ticked and drawn while it's active
+class Scene
+{
+    public:
+    std::string name {""};
+
+    // Idle scenes have nothing moving, so they only redraw after an event
+    bool isIdle {false};
+
+    std::vector<GameObject*> updateList {};
+    // Drawn into the scene target
+    std::vector<GameObject*> worldList {};
+    // Drawn on top at native resolution
+    std::vector<GameObject*> hudList {};
+
+    // Frame cost while this scene is active
+    int frames {0};
+    float busyTime {0.0f};
+    Uint64 enterTick {0};
+
+    void update();
+    void render(float scale);
+    void logStats();
+};
+void Scene::update()
+{
+    for (GameObject* object : updateList)
+    {
+        object->updatePosition();
+    }
+}
+void Scene::render(float scale)
+{
+    beginScene(scale);
+    for (GameObject* object : worldList)
+    {
+        object->render();
+    }
+
+    // Upscaling the scene before the HUD
+    presentScene(scale);
+    for (GameObject* object : hudList)
+    {
+        object->render();
+    }
+}
+void Scene::logStats()
+{
+    float seconds {(SDL_GetTicks() - enterTick) / 1000.0f};
+    if (frames > 0 && seconds > 0.0f)
+    {
+        SDL_Log("%s scene: %d frames in %.1f s, avg %.2f ms per frame, busy %.1f%% of the time",
+            name.c_str(), frames, seconds, busyTime * 1000.0f / frames, busyTime * 100.0f / seconds);
+    }
+    frames = 0;
+    busyTime = 0.0f;
+}
+
+// Damage tracker class, redraws only what moved since last frame into the scene target
+class DamageTracker
+{
+    public:
+    ~DamageTracker();
+
+    // The static objects at the bottom of the scene, drawn once
+    SDL_Texture* staticLayer {nullptr};
+    int bakedCount {0};
+    Scene* bakedScene {nullptr};
+
+    std::vector<SDL_FRect> dirtyRects {};
+
+    // Fraction of the scene target redrawn last frame, not counting the full copy of the target to the window
+    float touchedFraction {1.0f};
+
+    void invalidate();
+    void bake(Scene& scene);
+    void collect(Scene& scene);
+    void render(Scene& scene);
+};
+DamageTracker::~DamageTracker()
+{
+    SDL_DestroyTexture(staticLayer);
+    staticLayer = nullptr;
+}
+// Forces the static layer to be rebuilt and the whole screen redrawn
+void DamageTracker::invalidate()
+{
+    bakedScene = nullptr;
+}
+void DamageTracker::bake(Scene& scene)
+{
+    if (staticLayer == nullptr)
+    {
+        staticLayer = SDL_CreateTexture(globalRenderer, SDL_PIXELFORMAT_XRGB8888, SDL_TEXTUREACCESS_TARGET, kScreenWidth, kScreenHeight);
+        if (staticLayer == nullptr)
+        {
+            SDL_Log("Unable to create static layer! SDL error: %s\n", SDL_GetError());
+            return;
+        }
+        SDL_SetTextureBlendMode(staticLayer, SDL_BLENDMODE_NONE);
+    }
+
+    SDL_SetRenderTarget(globalRenderer, staticLayer);
+    SDL_SetRenderDrawColor(globalRenderer, 0x90, 0xB6, 0xFC, 0xFF);
+    SDL_RenderClear(globalRenderer);
+
+    // Everything below the first moving object can be drawn once
+    bakedCount = 0;
+    for (GameObject* object : scene.worldList)
+    {
+        if (!object->isStatic)
+        {
+            break;
+        }
+        object->render();
+        bakedCount++;
+    }
+
+    SDL_SetRenderTarget(globalRenderer, nullptr);
+    bakedScene = &scene;
+
+    // The target holds the last scene, so all of it needs redrawing
+    dirtyRects = {{0.0f, 0.0f, static_cast<float>(kScreenWidth), static_cast<float>(kScreenHeight)}};
+}
+// Works out which parts of the screen changed since last frame
+void DamageTracker::collect(Scene& scene)
+{
+    dirtyRects.clear();
+    for (std::vector<GameObject*>* list : {&scene.worldList, &scene.hudList})
+    {
+        for (GameObject* object : *list)
+        {
+            if (object->isStatic)
+            {
+                continue;
+            }
+
+            // Both where it was and where it is now
+            SDL_FRect damage {};
+            bool hasDamage {false};
+            if (object->wasDrawn)
+            {
+                damage = object->lastBounds;
+                hasDamage = true;
+            }
+            if (object->isVisible)
+            {
+                SDL_FRect bounds {object->getBounds()};
+                if (hasDamage)
+                {
+                    SDL_GetRectUnionFloat(&damage, &bounds, &damage);
+                }
+                else
+                {
+                    damage = bounds;
+                }
+                hasDamage = true;
+            }
+
+            if (hasDamage)
+            {
+                dirtyRects.push_back(damage);
+            }
+        }
+    }
+
+    // Overlapping regions are fine since each one restores the static layer first,
+    // so two regions are only merged when their union is no bigger than drawing both
+    bool merged {true};
+    while (merged)
+    {
+        merged = false;
+        for (size_t i = 0; i < dirtyRects.size() && !merged; i++)
+        {
+            for (size_t j = i + 1; j < dirtyRects.size() && !merged; j++)
+            {
+                SDL_FRect combined {};
+                SDL_GetRectUnionFloat(&dirtyRects[i], &dirtyRects[j], &combined);
+                if (combined.w * combined.h <= dirtyRects[i].w * dirtyRects[i].h + dirtyRects[j].w * dirtyRects[j].h)
+                {
+                    dirtyRects[i] = combined;
+                    dirtyRects.erase(dirtyRects.begin() + j);
+                    merged = true;
+                }
+            }
+        }
+    }
+}
+void DamageTracker::render(Scene& scene)
+{
+    if (bakedScene != &scene)
+    {
+        bake(scene);
+    }
+    else
+    {
+        collect(scene);
+    }
+
+    SDL_SetRenderTarget(globalRenderer, sceneTarget);
+    SDL_SetRenderScale(globalRenderer, 1.0f, 1.0f);
+
+    SDL_FRect screenRect {0.0f, 0.0f, static_cast<float>(kScreenWidth), static_cast<float>(kScreenHeight)};
+    float touchedPixels {0.0f};
+    for (SDL_FRect dirtyRect : dirtyRects)
+    {
+        // Snapping to whole pixels and keeping it on screen
+        float x1 {std::floor(dirtyRect.x)};
+        float y1 {std::floor(dirtyRect.y)};
+        SDL_FRect region {x1, y1, std::ceil(dirtyRect.x + dirtyRect.w) - x1, std::ceil(dirtyRect.y + dirtyRect.h) - y1};
+        if (SDL_GetRectIntersectionFloat(&region, &screenRect, &region) == false)
+        {
+            continue;
+        }
+        touchedPixels += region.w * region.h;
+
+        SDL_Rect clipRect {static_cast<int>(region.x), static_cast<int>(region.y), static_cast<int>(region.w), static_cast<int>(region.h)};
+        SDL_SetRenderClipRect(globalRenderer, &clipRect);
+
+        // Restoring the static layer, then everything on top of it that overlaps
+        SDL_RenderTexture(globalRenderer, staticLayer, &region, &region);
+        for (size_t i = bakedCount; i < scene.worldList.size(); i++)
+        {
+            GameObject* object {scene.worldList[i]};
+            SDL_FRect bounds {object->getBounds()};
+            if (object->isVisible && SDL_HasRectIntersectionFloat(&bounds, &region))
+            {
+                object->render();
+            }
+        }
+        for (GameObject* object : scene.hudList)
+        {
+            SDL_FRect bounds {object->getBounds()};
+            if (object->isVisible && SDL_HasRectIntersectionFloat(&bounds, &region))
+            {
+                object->render();
+            }
+        }
+    }
+    SDL_SetRenderClipRect(globalRenderer, nullptr);
+    touchedFraction = touchedPixels / (kScreenWidth * kScreenHeight);
+
+    // Remembering where everything is for next frame
+    for (std::vector<GameObject*>* list : {&scene.worldList, &scene.hudList})
+    {
+        for (GameObject* object : *list)
+        {
+            object->lastBounds = object->getBounds();
+            object->wasDrawn = object->isVisible;
+        }
+    }
+
+    // The window isn't kept between frames, so the whole target is copied to it
+    SDL_SetRenderTarget(globalRenderer, nullptr);
+    SDL_RenderTexture(globalRenderer, sceneTarget, nullptr, nullptr);
+}
+
+#ifdef SHOW_FRAME_STATS
+// Frame time statistics, logged every few seconds
+struct FrameStats
+{
+    int frames {0};
+    float totalTime {0.0f};
+    float worstTime {0.0f};
+    float totalTouched {0.0f};
+};
+void logFrameStats(FrameStats& stats, float frameTime, float scale, float touchedFraction)
+{
+    stats.frames++;
+    stats.totalTime += frameTime;
+    stats.worstTime = std::fmax(stats.worstTime, frameTime);
+    stats.totalTouched += touchedFraction;
+
+    if (stats.totalTime >= 2.0f)
+    {
+        SDL_Log("frames: %d avg: %.2f ms worst: %.2f ms scale: %.2f pixels redrawn into the scene target: %.1f%% (plus a full window copy) renderer: %s",
+            stats.frames, stats.totalTime * 1000.0f / stats.frames, stats.worstTime * 1000.0f, scale,
+            stats.totalTouched * 100.0f / stats.frames, SDL_GetRendererName(globalRenderer));
+        stats = {};
+    }
+}
+#endif
 /*
 void spawnRocks()
 {
@@ -427,18 +1036,6 @@ void spawnRocks()
 }
     */
 
-bool isBetween(float between, float a, float b)
-{
-    bool result {between < a && between > b};
-    
-    if (result == false)
-    {
-        result = {between > a && between < b};
-    }
-    
-    return result;
-}
-
 template <typename T>
 void clamp(T& toClamp, T minimum, T maximum)
 {
@@ -484,6 +1081,41 @@ SDL_Texture* getTextureFromFile(std::string path)
     return texture;
 }
 
+// Starts drawing the scene at the given fraction of the window resolution.
+// At full scale it draws straight to the window, so there's no extra copy.
+void beginScene(float scale)
+{
+    if (useDynamicResolution && scale < 1.0f)
+    {
+        SDL_SetRenderTarget(globalRenderer, sceneTarget);
+        SDL_SetRenderScale(globalRenderer, scale, scale);
+    }
+
+    // No clear needed, every scene starts with the opaque background layer
+}
+
+// Upscales the scene to the window, anything drawn afterwards is at native resolution
+void presentScene(float scale)
+{
+    if (useDynamicResolution && scale < 1.0f)
+    {
+        SDL_SetRenderTarget(globalRenderer, nullptr);
+
+        SDL_FRect srcRect {0.0f, 0.0f, kScreenWidth * scale, kScreenHeight * scale};
+        SDL_RenderTexture(globalRenderer, sceneTarget, &srcRect, nullptr);
+    }
+}
+
+// Pushes the event that switches to another scene at the start of the next frame
+void changeScene(int nextScene)
+{
+    SDL_Event sceneEvent;
+    SDL_zero(sceneEvent);
+    sceneEvent.type = sceneChangeEvent;
+    sceneEvent.user.code = nextScene;
+    SDL_PushEvent(&sceneEvent);
+}
+
 // Initializing
 bool init()
 {
@@ -510,6 +1142,30 @@ bool init()
                 SDL_Log("SDL could not create window! SDL error: %s\n", SDL_GetError());
                 success = false;
             }
+            else
+            {
+                // Create the scene target, falling back to drawing straight to the window
+                sceneTarget = SDL_CreateTexture(globalRenderer, SDL_PIXELFORMAT_XRGB8888, SDL_TEXTUREACCESS_TARGET, kScreenWidth, kScreenHeight);
+                if (sceneTarget == nullptr)
+                {
+                    SDL_Log("Unable to create scene target, dynamic resolution disabled! SDL error: %s\n", SDL_GetError());
+                    useDynamicResolution = false;
+                }
+                else
+                {
+                    // Opaque copy with nearest sampling is the cheapest upscale on the software renderer
+                    SDL_SetTextureBlendMode(sceneTarget, SDL_BLENDMODE_NONE);
+                    SDL_SetTextureScaleMode(sceneTarget, SDL_SCALEMODE_NEAREST);
+                }
+
+                // Registering the scene change event
+                sceneChangeEvent = SDL_RegisterEvents(1);
+                if (sceneChangeEvent == 0)
+                {
+                    SDL_Log("Unable to register scene change event! SDL error: %s\n", SDL_GetError());
+                    success = false;
+                }
+            }
         }
     }
 
@@ -518,7 +1174,9 @@ bool init()
 
 void close()
 {
-    // Destroy renderer and window
+    // Destroy scene target, renderer and window
+    SDL_DestroyTexture(sceneTarget);
+    sceneTarget = nullptr;
     SDL_DestroyRenderer(globalRenderer);
     globalRenderer = nullptr;
     SDL_DestroyWindow(globalWindow);
@@ -544,16 +1202,10 @@ int main(int argc, char* args[])
         // Quit flag
         bool quit = false;
 
-        // Game over flag
-        bool gameOver = false;
-
         // Event data
         SDL_Event event;
         SDL_zero(event);
 
-        // Vector of gameobjects
-        std::vector<GameObject*> allGameObjects;
-
         // Creating the background
         Background gameBackground;
 
@@ -565,22 +1217,29 @@ int main(int argc, char* args[])
         Rock rockExample2(true, snow, 30.0f);
 
         // Creating the ground
-        Ground gameGround;
+        Ground gameGround({snow, ice});
 
         // Creating scoreboard
         int score {0};
         int finalScore {};
         CollisionBox2D scoreChecker;
+        std::vector<CollisionEvent> collisions;
         float lastScoreTime{0};
         float timeSinceLastScore{0};
 
         TextMessage scoreboard;
 
         // Creating gameOver message
-        TextMessage gameOverMessage("Game Over!"s, 40, false);
-        TextMessage gameOverInstructions("press space to play again"s, 30, false);
+        TextMessage gameOverMessage("Game Over!"s, 40, true);
+        TextMessage gameOverInstructions("press space to play again"s, 30, true);
         gameOverInstructions.position[1] = gameOverMessage.position[1] + gameOverMessage.myHeight;
 
+        // Creating menu message
+        TextMessage titleMessage("Tappy Plane"s, 40, true);
+        TextMessage menuInstructions("press space to start"s, 30, true);
+        titleMessage.position[1] = kScreenHeight / 4.0f;
+        menuInstructions.position[1] = titleMessage.position[1] + titleMessage.myHeight;
+
         // Seeding random number generator
         std::mt19937 generator(std::chrono::high_resolution_clock::now().time_since_epoch().count());
         std::uniform_int_distribution<int> distribution(-rockExample.myHeight / 3, rockExample.myHeight / 3);
@@ -594,22 +1253,120 @@ int main(int argc, char* args[])
         // Display high score
         TextMessage highScoreMessage("High score: "s, 28, true);
         highScoreMessage.position = {highScoreMessage.myWidth / 10, highScoreMessage.myHeight};
+        highScoreMessage.message = "High score:"s + std::to_string(highscore);
+        highScoreMessage.updateTexture();
+
+        // Dynamic resolution
+        ResolutionScaler scaler;
+
+        // Dirty rectangles
+        DamageTracker damage;
+        Uint64 frameStart {0};
+
+        #ifdef SHOW_FRAME_STATS
+        FrameStats frameStats;
+        #endif
+
+        // Creating the scenes
+        Scene scenes[sceneCount];
+
+        scenes[menuScene].name = "menu"s;
+        scenes[menuScene].isIdle = true;
+        scenes[menuScene].worldList = {&gameBackground, &player, &gameGround};
+        scenes[menuScene].hudList = {&titleMessage, &menuInstructions, &highScoreMessage};
+
+        scenes[playingScene].name = "playing"s;
+        scenes[playingScene].updateList = {&player, &rockExample, &rockExample2, &gameGround};
+        scenes[playingScene].worldList = {&gameBackground, &player, &rockExample, &rockExample2, &gameGround};
+        scenes[playingScene].hudList = {&scoreboard, &highScoreMessage};
+
+        scenes[gameOverScene].name = "game over"s;
+        scenes[gameOverScene].isIdle = true;
+        scenes[gameOverScene].worldList = {&gameBackground, &gameGround};
+        scenes[gameOverScene].hudList = {&scoreboard, &gameOverMessage, &gameOverInstructions, &highScoreMessage};
+
+        int currentScene {menuScene};
+        scenes[currentScene].enterTick = SDL_GetTicks();
+
+        // Set when an idle scene has to draw again
+        bool redraw {true};
 
         // Main loop
         while (quit == false)
         {
+            // Idle scenes sleep until something happens instead of spinning
+            if (scenes[currentScene].isIdle && !redraw)
+            {
+                SDL_WaitEvent(nullptr);
+            }
+
             // Get event data
-            if (SDL_PollEvent(&event) == true)
+            while (SDL_PollEvent(&event) == true)
             {
                 // if event is quit type, end main loop
                 if (event.type == SDL_EVENT_QUIT)
                 {
-                    gameOver = true;
                     quit = true;
                 }
+                else if (event.type == sceneChangeEvent)
+                {
+                    #ifdef SHOW_FRAME_STATS
+                    scenes[currentScene].logStats();
+                    #endif
+
+                    currentScene = event.user.code;
+                    scenes[currentScene].enterTick = SDL_GetTicks();
+                    redraw = true;
+
+                    // Setting everything up once when a scene starts
+                    if (currentScene == playingScene)
+                    {
+                        player.position[1] = (kScreenHeight - player.myHeight) / 2;
+                        player.velocity[1] = {0.0f};
+                        player.degrees = {0.0};
+                        rockExample.position[0] = kScreenWidth;
+                        rockExample2.position[0] = kScreenWidth;
+                        rockExample.velocity = {kScrollSpeed, 0.0f};
+                        rockExample2.velocity = {kScrollSpeed, 0.0f};
+
+                        // The ground scrolls along with the rocks, so it's redrawn every frame
+                        gameGround.velocity = {kScrollSpeed, 0.0f};
+                        gameGround.isStatic = false;
+                        finalScore = 0;
+                        score = 0;
+
+                        scoreboard.message = "Score: "s + std::to_string(score);
+                        scoreboard.updateTexture();
+
+                        // So the time spent in the last scene isn't one huge step
+                        current_tick = SDL_GetTicks();
+                    }
+                    else if (currentScene == gameOverScene)
+                    {
+                        gameGround.velocity = {0.0f, 0.0f};
+                        gameGround.isStatic = true;
+
+                        scoreboard.message = "Final score: "s + std::to_string(finalScore);
+                        scoreboard.updateTexture();
+                    }
+                }
+                else if (event.type == SDL_EVENT_WINDOW_EXPOSED)
+                {
+                    redraw = true;
+                }
+                else if (event.type == SDL_EVENT_RENDER_TARGETS_RESET)
+                {
+                    // Target textures lost their contents, so the layers are composed again.
+                    // The scene target is redrawn every frame, and the dirty rectangle layers on the next one.
+                    SDL_Log("Render targets were reset, recomposing the scenery");
+                    gameBackground.compose();
+                    gameGround.compose();
+                    damage.invalidate();
+                    redraw = true;
+                }
                 else if (event.type == SDL_EVENT_KEY_UP)
                 {
-                    if (event.key.key == SDLK_UP)
+                    if (event.key.key == SDLK_UP && currentScene == playingScene)
                     {
                         player.velocity[1] = -350.0f;
                     }
@@ -617,141 +1374,176 @@ int main(int argc, char* args[])
                     {
                         SDL_Log("high score: %d", highscore);
                     }
-                    if (event.key.key == SDLK_SPACE && gameOver)
+                    if (event.key.key == SDLK_F1 && sceneTarget != nullptr)
                     {
-                        gameOver = false;
-                        player.position[1] = (kScreenHeight - player.myHeight) / 2;
-                        player.velocity[1] = {0.0f};
-                        rockExample.position[0] = kScreenWidth;
-                        rockExample2.position[0] = kScreenWidth;
-                        finalScore = 0;
-                        score = 0;
+                        useDynamicResolution = !useDynamicResolution;
+                        SDL_Log("dynamic resolution: %s", useDynamicResolution ? "on" : "off");
+                        redraw = true;
+                    }
+                    if (event.key.key == SDLK_F2 && sceneTarget != nullptr)
+                    {
+                        useDirtyRects = !useDirtyRects;
+                        SDL_Log("dirty rectangles: %s", useDirtyRects ? "on" : "off");
+                        damage.invalidate();
+                        redraw = true;
+                    }
+                    if (event.key.key == SDLK_SPACE && currentScene != playingScene)
+                    {
+                        changeScene(playingScene);
                     }
                 }
             }
+
+            // Nothing to do until an idle scene changes
+            if (quit || (scenes[currentScene].isIdle && !redraw))
+            {
+                continue;
+            }
+            redraw = false;
             
             // update deltatime
             last_tick = current_tick;
             current_tick = SDL_GetTicks();
             delta_time = (current_tick - last_tick) / 1000.0f;
+            frameStart = SDL_GetTicksNS();
 
-            // Fill the background
-            SDL_SetRenderDrawColor(globalRenderer, 0x90, 0xB6, 0xFC, 0xFF);
-            SDL_RenderClear(globalRenderer);
-            
-            // Background
-            gameBackground.render();
-
-            // Player
-            player.render();
-            player.updatePosition();
-            player.accelerate(0.0f, 400.0f);
-            clamp<float>(player.position[1], 0.0f, kScreenHeight - player.myHeight);
-
-            // Rock
-            rockExample.render();
-            rockExample.updatePosition();
-            rockExample2.render();
-            rockExample2.updatePosition();
-
-            // Ground
-            gameGround.render();
-
-            // Updating the player and rock according to the gameover flag
-            if (!gameOver)
-            {
-                rockExample.velocity = {-200.0f, 0.0f};
-                rockExample2.velocity = {-200.0f, 0.0f};
-                rockExample.isVisible = true;
-                rockExample2.isVisible = true;
-                player.isVisible = true;
-                gameOverMessage.isVisible = false;
-                gameOverInstructions.isVisible = false;
-                
-                scoreboard.message = "Score: "s + std::to_string(score);
-            }
-            else
+            // Moving everything the scene owns
+            scenes[currentScene].update();
+
+            if (currentScene == playingScene)
             {
-                rockExample.isVisible = false;
-                rockExample2.isVisible = false;
-                player.isVisible = false;
-                gameOverMessage.isVisible = true;
-                gameOverInstructions.isVisible = true;
+                // Player
+                player.accelerate(0.0f, 400.0f);
+                clamp<float>(player.position[1], 0.0f, kScreenHeight - player.myHeight);
 
-                scoreboard.message = "Final score: "s + std::to_string(finalScore);
-            }
+                // checking for collisions over the whole step, so a long frame can't skip past a rock or the gap
+                collisions.clear();
+                float impactTime {};
 
-            // checking for collisions
-            if (
-                !gameOver &&
-                (isCollided(player.myCollider, rockExample.myCollider) || 
-                isCollided(player.myCollider, rockExample2.myCollider) ||
-                isCollided(player.myCollider, gameGround.myCollider))
-            )
-            {
-                SDL_Log("game over! your score was %d", score);
-                finalScore = score;
-                score = 0;
-                gameOver = true;
-            }
+                if (sweptCollision(player.myCollider, player.displacement, rockExample.myCollider, rockExample.displacement, impactTime))
+                {
+                    collisions.push_back({impactTime, crash});
+                }
+                if (sweptCollision(player.myCollider, player.displacement, rockExample2.myCollider, rockExample2.displacement, impactTime))
+                {
+                    collisions.push_back({impactTime, crash});
+                }
+                if (sweptCollision(player.myCollider, player.displacement, gameGround.myCollider, gameGround.displacement, impactTime))
+                {
+                    collisions.push_back({impactTime, crash});
+                }
 
-            if (score > highscore)
-            {
-                highscore = score;
-                SDL_Log("new high score: %d", highscore);
-            }
+                // The gap between the rocks
+                scoreChecker = {rockExample.myCollider.x1, rockExample.myCollider.x2, rockExample2.myCollider.y2, rockExample.myCollider.y1};
+                if (sweptCollision(player.myCollider, player.displacement, scoreChecker, rockExample.displacement, impactTime))
+                {
+                    collisions.push_back({impactTime, scoreGate});
+                }
 
-            
-            // Checking if it passed the left side of the screen, then respawning it
-            if (rockExample.position[0] < -rockExample.myWidth && rockExample2.position[0] < -rockExample2.myWidth)
-            {
-                float random_number = static_cast<float>(distribution(generator));
+                // Resolving the earliest event first, anything after a crash doesn't count.
+                // On a tie the crash wins, since the gap shares its edges with the rocks.
+                std::sort(collisions.begin(), collisions.end(), [](CollisionEvent a, CollisionEvent b)
+                {
+                    if (a.time != b.time)
+                    {
+                        return a.time < b.time;
+                    }
+                    return a.type == crash && b.type == scoreGate;
+                });
+                for (CollisionEvent collision : collisions)
+                {
+                    if (collision.type == scoreGate)
+                    {
+                        if (timeSinceLastScore > 3 || score == 0)
+                        {
+                            lastScoreTime = {current_tick / 1000.0f};
+                            timeSinceLastScore = {0};
+                            score++;
+
+                            scoreboard.message = "Score: "s + std::to_string(score);
+                            scoreboard.updateTexture();
+
+                            // Checked here so a point scored just before a crash still counts
+                            if (score > highscore)
+                            {
+                                highscore = score;
+                                SDL_Log("new high score: %d", highscore);
+
+                                highScoreMessage.message = "High score:"s + std::to_string(highscore);
+                                highScoreMessage.updateTexture();
+                            }
+                        }
+                    }
+                    else
+                    {
+                        SDL_Log("game over! your score was %d", score);
+                        finalScore = score;
+                        score = 0;
+                        changeScene(gameOverScene);
+                        break;
+                    }
+                }
+                timeSinceLastScore = {(current_tick / 1000.0f) - lastScoreTime};
 
-                rockExample.position[0] = kScreenWidth + rockExample.myWidth;
-                rockExample2.position[0] = kScreenWidth + rockExample2.myWidth;
+                // Checking if it passed the left side of the screen, then respawning it
+                if (rockExample.position[0] < -rockExample.myWidth && rockExample2.position[0] < -rockExample2.myWidth)
+                {
+                    float random_number = static_cast<float>(distribution(generator));
 
-                // shifts the rock a random amount
-                
-                rockExample.position[1] = static_cast<float>(kScreenHeight - rockExample.myHeight) + random_number + 150.0f;
-                rockExample2.position[1] = random_number - 150.0f;
-                
-            }
+                    rockExample.position[0] = kScreenWidth + rockExample.myWidth;
+                    rockExample2.position[0] = kScreenWidth + rockExample2.myWidth;
 
-            // Rendering the scoreboard
-            scoreboard.updateTexture();
-            scoreboard.render();
+                    // shifts the rock a random amount
+                    
+                    rockExample.position[1] = static_cast<float>(kScreenHeight - rockExample.myHeight) + random_number + 150.0f;
+                    rockExample2.position[1] = random_number - 150.0f;
+                    
+                }
+            }
 
-            // scorechecker and updating the score
-            scoreChecker = {rockExample.myCollider.x1, rockExample.myCollider.x2, rockExample.myCollider.y2, rockExample2.myCollider.y1};
-            if (isCollided(player.myCollider, scoreChecker) && (timeSinceLastScore > 3 || score == 0))
+            // Drawing the scene and its HUD, dirty rectangles already cut the fill cost so they run at full resolution
+            float sceneScale {useDynamicResolution && !useDirtyRects ? scaler.scale : 1.0f};
+            if (useDirtyRects)
+            {
+                damage.render(scenes[currentScene]);
+            }
+            else
             {
-                lastScoreTime = {current_tick / 1000.0f};
-                timeSinceLastScore = {0};
-                score++;
-                
+                scenes[currentScene].render(sceneScale);
+                damage.touchedFraction = 1.0f;
             }
-            timeSinceLastScore = {(current_tick / 1000.0f) - lastScoreTime};
 
             // The collider display for the collider that checks if the player passed between the rocks
             #ifdef SHOW_COLLIDERS
-            SDL_FRect sCheckRect {scoreChecker.x1, scoreChecker.y1, scoreChecker.x2 - scoreChecker.x1, scoreChecker.y2 - scoreChecker.y1};
-            SDL_FRect *sCheckPtr {&sCheckRect};
-            SDL_RenderRect(globalRenderer, sCheckPtr);
+            if (currentScene == playingScene)
+            {
+                SDL_FRect sCheckRect {scoreChecker.x1, scoreChecker.y1, scoreChecker.x2 - scoreChecker.x1, scoreChecker.y2 - scoreChecker.y1};
+                SDL_FRect *sCheckPtr {&sCheckRect};
+                SDL_RenderRect(globalRenderer, sCheckPtr);
+            }
             #endif
 
-            // Rendering the gameover message
-            gameOverMessage.render();
-            gameOverInstructions.render();
-
-            // Rendering the highscore message
-            highScoreMessage.message = "High score:"s + std::to_string(highscore);
-            highScoreMessage.updateTexture();
-            highScoreMessage.render();
-
-            //spawnRocks();
             // Update the screen
             SDL_RenderPresent(globalRenderer);
+
+            // Adjusting the resolution from how long this frame took
+            float frameTime {(SDL_GetTicksNS() - frameStart) / 1000000000.0f};
+            if (useDynamicResolution && !useDirtyRects && !scenes[currentScene].isIdle)
+            {
+                scaler.update(frameTime);
+            }
+
+            #ifdef SHOW_FRAME_STATS
+            scenes[currentScene].frames++;
+            scenes[currentScene].busyTime += frameTime;
+            logFrameStats(frameStats, frameTime, sceneScale, damage.touchedFraction);
+            #endif
         }
+
+        #ifdef SHOW_FRAME_STATS
+        scenes[currentScene].logStats();
+        #endif
+
         SDL_Log("Quitted!");
         std::ofstream writeHighScore {"../../highscore.txt"s};
         writeHighScore << highscore;
@@ -761,4 +1553,3 @@ int main(int argc, char* args[])
     return exitCode;
 
 }
-